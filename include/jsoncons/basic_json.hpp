@@ -722,7 +722,18 @@ private:
             }
         }
 
-        void destroy() noexcept
+        template <class A=Allocator>
+        typename std::enable_if<jsoncons::detail::is_stateless<A>::value,void>::type
+        destroy() noexcept
+        {
+            array_allocator alloc;
+            std::allocator_traits<array_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
+            std::allocator_traits<array_allocator>::deallocate(alloc, ptr_,1);
+        }
+
+        template <class A=Allocator>
+        typename std::enable_if<!jsoncons::detail::is_stateless<A>::value,void>::type
+        destroy() noexcept
         {
             array_allocator alloc(ptr_->get_allocator());
             std::allocator_traits<array_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
@@ -876,7 +887,18 @@ private:
         }
     private:
 
-        void destroy() noexcept
+        template <class A=Allocator>
+        typename std::enable_if<jsoncons::detail::is_stateless<A>::value,void>::type
+        destroy() noexcept
+        {
+            object_allocator alloc;
+            std::allocator_traits<object_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
+            std::allocator_traits<object_allocator>::deallocate(alloc, ptr_,1);
+        }
+
+        template <class A=Allocator>
+        typename std::enable_if<!jsoncons::detail::is_stateless<A>::value,void>::type
+        destroy() noexcept
         {
             object_allocator alloc(ptr_->get_allocator());
             std::allocator_traits<object_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
@@ -928,16 +950,8 @@ private:
         basic_json& evaluate_with_default()
         {
             basic_json& val = parent_.evaluate_with_default();
-            auto it = val.find(key_);
-            if (it == val.object_range().end())
-            {
-                auto r = val.try_emplace(key_, json_object_arg, semantic_tag::none, val.object_value().get_allocator());
-                return r.first->value();
-            }
-            else
-            {
-                return it->value();
-            }
+            auto r = val.try_emplace(key_, json_object_arg, semantic_tag::none, val.object_value().get_allocator());
+            return r.first->value();
         }
 
         basic_json& evaluate(std::size_t index)
@@ -963,7 +977,7 @@ private:
         using proxied_type = basic_json;
         using proxy_type = proxy<typename ParentType::proxy_type>;
 
-        basic_json& evaluate() 
+        basic_json& evaluate()
         {
             return parent_.evaluate(key_);
         }
@@ -973,6 +987,25 @@ private:
             return parent_.evaluate(key_);
         }
 
+        // Returns the address of the proxied member if the whole chain
+        // resolves, nullptr otherwise.  One lookup per level, unlike
+        // contains() followed by evaluate() which probes the key twice.
+        const basic_json* try_evaluate() const noexcept
+        {
+            const basic_json* p = parent_.try_evaluate();
+            while (JSONCONS_UNLIKELY(p != nullptr && p->storage() == storage_kind::json_const_pointer))
+            {
+                p = p->cast<json_const_pointer_storage>().value();
+            }
+            if (JSONCONS_UNLIKELY(p == nullptr || p->storage() != storage_kind::object_value))
+            {
+                return nullptr;
+            }
+            const object& o = p->cast<object_storage>().value();
+            auto it = o.find(key_);
+            return it == o.end() ? nullptr : std::addressof(it->value());
+        }
+
         operator basic_json&()
         {
             return evaluate();
@@ -1005,11 +1038,8 @@ private:
 
         std::size_t size() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return 0;
-            }
-            return evaluate().size();
+            const basic_json* p = try_evaluate();
+            return p == nullptr ? 0 : p->size();
         }
 
         storage_kind storage() const
@@ -1044,30 +1074,20 @@ private:
 
         bool contains(const string_view_type& key) const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-
-            return evaluate().contains(key);
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->contains(key);
         }
 
         bool is_null() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_null();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_null();
         }
 
         bool empty() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return true;
-            }
-            return evaluate().empty();
+            const basic_json* p = try_evaluate();
+            return p == nullptr ? true : p->empty();
         }
 
         std::size_t capacity() const
@@ -1094,127 +1114,85 @@ private:
         template<class T, class... Args>
         bool is(Args&&... args) const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().template is<T>(std::forward<Args>(args)...);
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->template is<T>(std::forward<Args>(args)...);
         }
 
         bool is_string() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_string();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_string();
         }
 
         bool is_string_view() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_string_view();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_string_view();
         }
 
         bool is_byte_string() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_byte_string();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_byte_string();
         }
 
         bool is_byte_string_view() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_byte_string_view();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_byte_string_view();
         }
 
         bool is_bignum() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_bignum();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_bignum();
         }
 
         bool is_number() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_number();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_number();
         }
         bool is_bool() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_bool();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_bool();
         }
 
         bool is_object() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_object();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_object();
         }
 
         bool is_array() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_array();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_array();
         }
 
         bool is_int64() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_int64();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_int64();
         }
 
         bool is_uint64() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_uint64();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_uint64();
         }
 
         bool is_half() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_half();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_half();
         }
 
         bool is_double() const noexcept
         {
-            if (!parent_.contains(key_))
-            {
-                return false;
-            }
-            return evaluate().is_double();
+            const basic_json* p = try_evaluate();
+            return p != nullptr && p->is_double();
         }
 
         string_view_type as_string_view() const 
@@ -1396,7 +1374,7 @@ private:
 
         void merge(basic_json&& source)
         {
-            return evaluate().merge(std::forward<basic_json>(source));
+            return evaluate().merge(std::move(source));
         }
 
         void merge(object_iterator hint, const basic_json& source)
@@ -1406,7 +1384,7 @@ private:
 
         void merge(object_iterator hint, basic_json&& source)
         {
-            return evaluate().merge(hint, std::forward<basic_json>(source));
+            return evaluate().merge(hint, std::move(source));
         }
 
         // merge_or_update
@@ -1418,7 +1396,7 @@ private:
 
         void merge_or_update(basic_json&& source)
         {
-            return evaluate().merge_or_update(std::forward<basic_json>(source));
+            return evaluate().merge_or_update(std::move(source));
         }
 
         void merge_or_update(object_iterator hint, const basic_json& source)
@@ -1428,7 +1406,7 @@ private:
 
         void merge_or_update(object_iterator hint, basic_json&& source)
         {
-            return evaluate().merge_or_update(hint, std::forward<basic_json>(source));
+            return evaluate().merge_or_update(hint, std::move(source));
         }
 
         template <class T>
@@ -1932,143 +1910,143 @@ private:
     struct identity { using type = T*; };
 
     template <class T> 
-    T& cast()
+    T& cast() noexcept
     {
         return cast(identity<T>());
     }
 
     template <class T> 
-    const T& cast() const
+    const T& cast() const noexcept
     {
         return cast(identity<T>());
     }
 
-    null_storage& cast(identity<null_storage>) 
+    null_storage& cast(identity<null_storage>) noexcept
     {
         return null_stor_;
     }
 
-    const null_storage& cast(identity<null_storage>) const
+    const null_storage& cast(identity<null_storage>) const noexcept
     {
         return null_stor_;
     }
 
-    empty_object_storage& cast(identity<empty_object_storage>) 
+    empty_object_storage& cast(identity<empty_object_storage>) noexcept
     {
         return empty_object_stor_;
     }
 
-    const empty_object_storage& cast(identity<empty_object_storage>) const
+    const empty_object_storage& cast(identity<empty_object_storage>) const noexcept
     {
         return empty_object_stor_;
     }
 
-    bool_storage& cast(identity<bool_storage>) 
+    bool_storage& cast(identity<bool_storage>) noexcept
     {
         return bool_stor_;
     }
 
-    const bool_storage& cast(identity<bool_storage>) const
+    const bool_storage& cast(identity<bool_storage>) const noexcept
     {
         return bool_stor_;
     }
 
-    int64_storage& cast(identity<int64_storage>) 
+    int64_storage& cast(identity<int64_storage>) noexcept
     {
         return int64_stor_;
     }
 
-    const int64_storage& cast(identity<int64_storage>) const
+    const int64_storage& cast(identity<int64_storage>) const noexcept
     {
         return int64_stor_;
     }
 
-    uint64_storage& cast(identity<uint64_storage>) 
+    uint64_storage& cast(identity<uint64_storage>) noexcept
     {
         return uint64_stor_;
     }
 
-    const uint64_storage& cast(identity<uint64_storage>) const
+    const uint64_storage& cast(identity<uint64_storage>) const noexcept
     {
         return uint64_stor_;
     }
 
-    half_storage& cast(identity<half_storage>)
+    half_storage& cast(identity<half_storage>) noexcept
     {
         return half_stor_;
     }
 
-    const half_storage& cast(identity<half_storage>) const
+    const half_storage& cast(identity<half_storage>) const noexcept
     {
         return half_stor_;
     }
 
-    double_storage& cast(identity<double_storage>) 
+    double_storage& cast(identity<double_storage>) noexcept
     {
         return double_stor_;
     }
 
-    const double_storage& cast(identity<double_storage>) const
+    const double_storage& cast(identity<double_storage>) const noexcept
     {
         return double_stor_;
     }
 
-    short_string_storage& cast(identity<short_string_storage>)
+    short_string_storage& cast(identity<short_string_storage>) noexcept
     {
         return short_string_stor_;
     }
 
-    const short_string_storage& cast(identity<short_string_storage>) const
+    const short_string_storage& cast(identity<short_string_storage>) const noexcept
     {
         return short_string_stor_;
     }
 
-    long_string_storage& cast(identity<long_string_storage>)
+    long_string_storage& cast(identity<long_string_storage>) noexcept
     {
         return long_string_stor_;
     }
 
-    const long_string_storage& cast(identity<long_string_storage>) const
+    const long_string_storage& cast(identity<long_string_storage>) const noexcept
     {
         return long_string_stor_;
     }
 
-    byte_string_storage& cast(identity<byte_string_storage>)
+    byte_string_storage& cast(identity<byte_string_storage>) noexcept
     {
         return byte_string_stor_;
     }
 
-    const byte_string_storage& cast(identity<byte_string_storage>) const
+    const byte_string_storage& cast(identity<byte_string_storage>) const noexcept
     {
         return byte_string_stor_;
     }
 
-    object_storage& cast(identity<object_storage>)
+    object_storage& cast(identity<object_storage>) noexcept
     {
         return object_stor_;
     }
 
-    const object_storage& cast(identity<object_storage>) const
+    const object_storage& cast(identity<object_storage>) const noexcept
     {
         return object_stor_;
     }
 
-    array_storage& cast(identity<array_storage>)
+    array_storage& cast(identity<array_storage>) noexcept
     {
         return array_stor_;
     }
 
-    const array_storage& cast(identity<array_storage>) const
+    const array_storage& cast(identity<array_storage>) const noexcept
     {
         return array_stor_;
     }
 
-    json_const_pointer_storage& cast(identity<json_const_pointer_storage>) 
+    json_const_pointer_storage& cast(identity<json_const_pointer_storage>) noexcept
     {
         return json_const_pointer_stor_;
     }
 
-    const json_const_pointer_storage& cast(identity<json_const_pointer_storage>) const
+    const json_const_pointer_storage& cast(identity<json_const_pointer_storage>) const noexcept
     {
         return json_const_pointer_stor_;
     }
@@ -2219,7 +2197,7 @@ private:
 
     void Init_rv_(basic_json&& val, const Allocator&, std::true_type) noexcept
     {
-        Init_rv_(std::forward<basic_json>(val));
+        Init_rv_(std::move(val));
     }
 
     void Init_rv_(basic_json&& val, const Allocator& a, std::false_type) noexcept
@@ -2235,13 +2213,13 @@ private:
             case storage_kind::bool_value:
             case storage_kind::short_string_value:
             case storage_kind::json_const_pointer:
-                Init_(std::forward<basic_json>(val));
+                Init_(std::move(val));
                 break;
             case storage_kind::long_string_value:
             {
                 if (a == val.cast<long_string_storage>().get_allocator())
                 {
-                    Init_rv_(std::forward<basic_json>(val), a, std::true_type());
+                    Init_rv_(std::move(val), a, std::true_type());
                 }
                 else
                 {
@@ -2253,7 +2231,7 @@ private:
             {
                 if (a == val.cast<byte_string_storage>().get_allocator())
                 {
-                    Init_rv_(std::forward<basic_json>(val), a, std::true_type());
+                    Init_rv_(std::move(val), a, std::true_type());
                 }
                 else
                 {
@@ -2265,7 +2243,7 @@ private:
             {
                 if (a == val.cast<object_storage>().get_allocator())
                 {
-                    Init_rv_(std::forward<basic_json>(val), a, std::true_type());
+                    Init_rv_(std::move(val), a, std::true_type());
                 }
                 else
                 {
@@ -2277,7 +2255,7 @@ private:
             {
                 if (a == val.cast<array_storage>().get_allocator())
                 {
-                    Init_rv_(std::forward<basic_json>(val), a, std::true_type());
+                    Init_rv_(std::move(val), a, std::true_type());
                 }
                 else
                 {
@@ -2290,11 +2268,50 @@ private:
         }
     }
 
-    basic_json& evaluate_with_default() 
+    basic_json& evaluate_with_default()
     {
         return *this;
     }
 
+    const basic_json* try_evaluate() const noexcept
+    {
+        return this;
+    }
+
+    // Exact three-way comparison of an int64 against a double, avoiding the
+    // round trip through double that loses precision above 2^53.  Truncation
+    // is exact in the remaining range: any double of magnitude above 2^53 is
+    // already an integer.  NaN compares greater, matching the subtraction
+    // code this replaces.
+    static int compare_int64_double(int64_t x, double y) noexcept
+    {
+        if (y != y)
+            return 1;
+        if (y >= 9223372036854775808.0) // 2^63
+            return -1;
+        if (y < -9223372036854775808.0)
+            return 1;
+        int64_t t = static_cast<int64_t>(y);
+        if (x != t)
+            return x < t ? -1 : 1;
+        double frac = y - static_cast<double>(t);
+        return frac == 0.0 ? 0 : (frac > 0.0 ? -1 : 1);
+    }
+
+    static int compare_uint64_double(uint64_t x, double y) noexcept
+    {
+        if (y != y)
+            return 1;
+        if (y >= 18446744073709551616.0) // 2^64
+            return -1;
+        if (y < 0.0)
+            return 1;
+        uint64_t t = static_cast<uint64_t>(y);
+        if (x != t)
+            return x < t ? -1 : 1;
+        return y - static_cast<double>(t) == 0.0 ? 0 : -1;
+    }
+
     basic_json& evaluate(const string_view_type& name) 
     {
         return at(name);
@@ -2321,8 +2338,22 @@ public:
     {
         if (this != &val)
         {
-            Destroy_();
-            Init_(val);
+            if (jsoncons::detail::is_stateless<Allocator>::value &&
+                storage() == storage_kind::object_value && val.storage() == storage_kind::object_value)
+            {
+                // Same-kind fast path: assign into the existing object body,
+                // reusing its capacity instead of freeing and reallocating it.
+                // Stateless allocators only: container assignment would adopt
+                // the source's allocator while the members keep allocating
+                // with the destination's.
+                cast<object_storage>().value() = val.cast<object_storage>().value();
+                cast<object_storage>().tag_ = val.cast<object_storage>().tag_;
+            }
+            else
+            {
+                Destroy_();
+                Init_(val);
+            }
         }
         return *this;
     }
@@ -2336,7 +2367,7 @@ public:
         return *this;
     }
 
-    storage_kind storage() const
+    storage_kind storage() const noexcept
     {
         // It is legal to access 'common_stor_.storage_' even though 
         // common_stor_ is not the active member of the union because 'storage_' 
@@ -2345,56 +2376,45 @@ public:
         return static_cast<storage_kind>(common_stor_.storage_);
     }
 
-    json_type type() const
+    json_type type() const noexcept
     {
-        switch(storage())
+        // Dense table keyed on storage_kind, cheaper than a 12-way switch
+        // on compilers that lower the switch to a branch chain.
+        static const json_type types[] = {
+            json_type::null_value,        // storage_kind::null_value
+            json_type::bool_value,        // storage_kind::bool_value
+            json_type::int64_value,       // storage_kind::int64_value
+            json_type::uint64_value,      // storage_kind::uint64_value
+            json_type::half_value,        // storage_kind::half_value
+            json_type::double_value,      // storage_kind::double_value
+            json_type::string_value,      // storage_kind::short_string_value
+            json_type::string_value,      // storage_kind::long_string_value
+            json_type::byte_string_value, // storage_kind::byte_string_value
+            json_type::array_value,       // storage_kind::array_value
+            json_type::object_value,      // storage_kind::empty_object_value
+            json_type::object_value      // storage_kind::object_value
+        };
+        if (JSONCONS_UNLIKELY(storage() == storage_kind::json_const_pointer))
         {
-            case storage_kind::null_value:
-                return json_type::null_value;
-            case storage_kind::bool_value:
-                return json_type::bool_value;
-            case storage_kind::int64_value:
-                return json_type::int64_value;
-            case storage_kind::uint64_value:
-                return json_type::uint64_value;
-            case storage_kind::half_value:
-                return json_type::half_value;
-            case storage_kind::double_value:
-                return json_type::double_value;
-            case storage_kind::short_string_value:
-            case storage_kind::long_string_value:
-                return json_type::string_value;
-            case storage_kind::byte_string_value:
-                return json_type::byte_string_value;
-            case storage_kind::array_value:
-                return json_type::array_value;
-            case storage_kind::empty_object_value:
-            case storage_kind::object_value:
-                return json_type::object_value;
-            case storage_kind::json_const_pointer:
-                return cast<json_const_pointer_storage>().value()->type();
-            default:
-                JSONCONS_UNREACHABLE();
-                break;
+            return cast<json_const_pointer_storage>().value()->type();
         }
+        return types[common_stor_.storage_];
     }
 
-    semantic_tag tag() const
+    semantic_tag tag() const noexcept
     {
-        // It is legal to access 'common_stor_.tag_' even though 
-        // common_stor_ is not the active member of the union because 'tag_' 
+        // It is legal to access 'common_stor_.tag_' even though
+        // common_stor_ is not the active member of the union because 'tag_'
         // is a part of the common initial sequence of all union members
         // as defined in 11.4-25 of the Standard.
-        switch(storage())
+        if (JSONCONS_UNLIKELY(storage() == storage_kind::json_const_pointer))
         {
-            case storage_kind::json_const_pointer:
-                return cast<json_const_pointer_storage>().value()->tag();
-            default:
-                return common_stor_.tag_;
+            return cast<json_const_pointer_storage>().value()->tag();
         }
+        return common_stor_.tag_;
     }
 
-    std::size_t size() const
+    std::size_t size() const noexcept
     {
         switch (storage())
         {
@@ -2479,7 +2499,13 @@ public:
                 switch (rhs.storage())
                 {
                     case storage_kind::json_const_pointer:
-                        return (cast<json_const_pointer_storage>().value())->compare(*(rhs.cast<json_const_pointer_storage>().value()));
+                    {
+                        // Two views of the same value compare equal without
+                        // walking the referenced document.
+                        const basic_json* lhs_p = cast<json_const_pointer_storage>().value();
+                        const basic_json* rhs_p = rhs.cast<json_const_pointer_storage>().value();
+                        return lhs_p == rhs_p ? 0 : lhs_p->compare(*rhs_p);
+                    }
                     default:
                         return (cast<json_const_pointer_storage>().value())->compare(rhs);
                 }
@@ -2527,10 +2553,7 @@ public:
                         else
                             return static_cast<uint64_t>(cast<int64_storage>().value()) < rhs.cast<uint64_storage>().value() ? -1 : 1;
                     case storage_kind::double_value:
-                    {
-                        double r = static_cast<double>(cast<int64_storage>().value()) - rhs.cast<double_storage>().value();
-                        return r == 0.0 ? 0 : (r < 0.0 ? -1 : 1);
-                    }
+                        return compare_int64_double(cast<int64_storage>().value(), rhs.cast<double_storage>().value());
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
@@ -2548,15 +2571,12 @@ public:
                         else
                             return cast<uint64_storage>().value() < static_cast<uint64_t>(rhs.cast<int64_storage>().value()) ? -1 : 1;
                     case storage_kind::uint64_value:
-                        if (cast<uint64_storage>().value() == static_cast<uint64_t>(rhs.cast<int64_storage>().value()))
+                        if (cast<uint64_storage>().value() == rhs.cast<uint64_storage>().value())
                             return 0;
                         else
-                            return cast<uint64_storage>().value() < static_cast<uint64_t>(rhs.cast<int64_storage>().value()) ? -1 : 1;
+                            return cast<uint64_storage>().value() < rhs.cast<uint64_storage>().value() ? -1 : 1;
                     case storage_kind::double_value:
-                    {
-                        auto r = static_cast<double>(cast<uint64_storage>().value()) - rhs.cast<double_storage>().value();
-                        return r == 0 ? 0 : (r < 0.0 ? -1 : 1);
-                    }
+                        return compare_uint64_double(cast<uint64_storage>().value(), rhs.cast<double_storage>().value());
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
@@ -2567,15 +2587,9 @@ public:
                 switch (rhs.storage())
                 {
                     case storage_kind::int64_value:
-                    {
-                        auto r = cast<double_storage>().value() - static_cast<double>(rhs.cast<int64_storage>().value());
-                        return r == 0 ? 0 : (r < 0.0 ? -1 : 1);
-                    }
+                        return -compare_int64_double(rhs.cast<int64_storage>().value(), cast<double_storage>().value());
                     case storage_kind::uint64_value:
-                    {
-                        auto r = cast<double_storage>().value() - static_cast<double>(rhs.cast<uint64_storage>().value());
-                        return r == 0 ? 0 : (r < 0.0 ? -1 : 1);
-                    }
+                        return -compare_uint64_double(rhs.cast<uint64_storage>().value(), cast<double_storage>().value());
                     case storage_kind::double_value:
                     {
                         auto r = cast<double_storage>().value() - rhs.cast<double_storage>().value();
@@ -2592,7 +2606,6 @@ public:
                 switch (rhs.storage())
                 {
                     case storage_kind::short_string_value:
-                        return as_string_view().compare(rhs.as_string_view());
                     case storage_kind::long_string_value:
                         return as_string_view().compare(rhs.as_string_view());
                     case storage_kind::json_const_pointer:
@@ -2827,11 +2840,11 @@ public:
     {
         const size_t dim1 = dim - 1;
 
-        basic_json val = make_array<dim1>(std::forward<Args>(args)...);
-        val.resize(n);
+        basic_json val = make_array();
+        val.reserve(n);
         for (std::size_t i = 0; i < n; ++i)
         {
-            val[i] = make_array<dim1>(std::forward<Args>(args)...);
+            val.push_back(make_array<dim1>(std::forward<Args>(args)...));
         }
         return val;
     }
@@ -2874,12 +2887,12 @@ public:
 
     basic_json(basic_json&& other) noexcept
     {
-        Init_rv_(std::forward<basic_json>(other));
+        Init_rv_(std::move(other));
     }
 
     basic_json(basic_json&& other, const Allocator&) noexcept
     {
-        Init_rv_(std::forward<basic_json>(other));
+        Init_rv_(std::move(other));
     }
 
     explicit basic_json(json_object_arg_t, 
@@ -3294,7 +3307,7 @@ public:
               std::error_code& ec) const
     {
         basic_compact_json_encoder<char_type,jsoncons::string_sink<Container>> encoder(s, options);
-        dump(encoder, ec);
+        dump_to(encoder, ec);
     }
 
     template <class Container>
@@ -3303,7 +3316,7 @@ public:
               std::error_code& ec) const
     {
         basic_compact_json_encoder<char_type,jsoncons::string_sink<Container>> encoder(s);
-        dump(encoder, ec);
+        dump_to(encoder, ec);
     }
 
     void dump(std::basic_ostream<char_type>& os, 
@@ -3311,14 +3324,14 @@ public:
               std::error_code& ec) const
     {
         basic_compact_json_encoder<char_type> encoder(os, options);
-        dump(encoder, ec);
+        dump_to(encoder, ec);
     }
 
     void dump(std::basic_ostream<char_type>& os, 
               std::error_code& ec) const
     {
         basic_compact_json_encoder<char_type> encoder(os);
-        dump(encoder, ec);
+        dump_to(encoder, ec);
     }
 
     // dump_pretty
@@ -3330,7 +3343,7 @@ public:
                      std::error_code& ec) const
     {
         basic_json_encoder<char_type,jsoncons::string_sink<Container>> encoder(s, options);
-        dump(encoder, ec);
+        dump_to(encoder, ec);
     }
 
     template <class Container>
@@ -3346,7 +3359,7 @@ public:
                      std::error_code& ec) const
     {
         basic_json_encoder<char_type> encoder(os, options);
-        dump(encoder, ec);
+        dump_to(encoder, ec);
     }
 
     void dump_pretty(std::basic_ostream<char_type>& os, 
@@ -3422,12 +3435,7 @@ public:
     void dump(basic_json_visitor<char_type>& visitor, 
               std::error_code& ec) const
     {
-        dump_noflush(visitor, ec);
-        if (ec)
-        {
-            return;
-        }
-        visitor.flush();
+        dump_to(visitor, ec);
     }
 
     bool is_null() const noexcept
@@ -3468,7 +3476,7 @@ public:
         }
     }
 
-    uint64_t ext_tag() const
+    uint64_t ext_tag() const noexcept
     {
         switch (storage())
         {
@@ -3489,8 +3497,8 @@ public:
         {
             case storage_kind::object_value:
             {
-                auto it = object_value().find(key);
-                return it != object_value().end();
+                auto it = cast<object_storage>().value().find(key);
+                return it != cast<object_storage>().value().end();
             }
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->contains(key);
@@ -3505,13 +3513,13 @@ public:
         {
             case storage_kind::object_value:
             {
-                auto it = object_value().find(key);
-                if (it == object_value().end())
+                auto it = cast<object_storage>().value().find(key);
+                if (it == cast<object_storage>().value().end())
                 {
                     return 0;
                 }
                 std::size_t count = 0;
-                while (it != object_value().end()&& it->key() == key)
+                while (it != cast<object_storage>().value().end()&& it->key() == key)
                 {
                     ++count;
                     ++it;
@@ -3714,11 +3722,11 @@ public:
             case storage_kind::long_string_value:
                 return cast<long_string_storage>().length() == 0;
             case storage_kind::array_value:
-                return array_value().empty();
+                return cast<array_storage>().value().empty();
             case storage_kind::empty_object_value:
                 return true;
             case storage_kind::object_value:
-                return object_value().empty();
+                return cast<object_storage>().value().empty();
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->empty();
             default:
@@ -3726,14 +3734,14 @@ public:
         }
     }
 
-    std::size_t capacity() const
+    std::size_t capacity() const noexcept
     {
         switch (storage())
         {
             case storage_kind::array_value:
-                return array_value().capacity();
+                return cast<array_storage>().value().capacity();
             case storage_kind::object_value:
-                return object_value().capacity();
+                return cast<object_storage>().value().capacity();
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->capacity();
             default:
@@ -3764,17 +3772,17 @@ public:
             switch (storage())
             {
                 case storage_kind::array_value:
-                    array_value().reserve(n);
+                    cast<array_storage>().value().reserve(n);
                     break;
                 case storage_kind::empty_object_value:
                 {
                     create_object_implicitly();
-                    object_value().reserve(n);
+                    cast<object_storage>().value().reserve(n);
                 }
                 break;
                 case storage_kind::object_value:
                 {
-                    object_value().reserve(n);
+                    cast<object_storage>().value().reserve(n);
                 }
                     break;
                 default:
@@ -3788,7 +3796,7 @@ public:
         switch (storage())
         {
             case storage_kind::array_value:
-                array_value().resize(n);
+                cast<array_storage>().value().resize(n);
                 break;
             default:
                 break;
@@ -3801,7 +3809,7 @@ public:
         switch (storage())
         {
             case storage_kind::array_value:
-                array_value().resize(n, val);
+                cast<array_storage>().value().resize(n, val);
                 break;
             default:
                 break;
@@ -4039,6 +4047,30 @@ public:
             {
                 return string_type(as_string_view().data(),as_string_view().length(),alloc);
             }
+            case storage_kind::null_value:
+            {
+                static const char_type null_literal[] = {'n','u','l','l'};
+                return string_type(null_literal,4,alloc);
+            }
+            case storage_kind::bool_value:
+            {
+                static const char_type true_literal[] = {'t','r','u','e'};
+                static const char_type false_literal[] = {'f','a','l','s','e'};
+                return cast<bool_storage>().value() ? string_type(true_literal,4,alloc)
+                                                    : string_type(false_literal,5,alloc);
+            }
+            case storage_kind::int64_value:
+            {
+                string_type s(alloc);
+                jsoncons::detail::from_integer(cast<int64_storage>().value(), s);
+                return s;
+            }
+            case storage_kind::uint64_value:
+            {
+                string_type s(alloc);
+                jsoncons::detail::from_integer(cast<uint64_storage>().value(), s);
+                return s;
+            }
             case storage_kind::byte_string_value:
             {
                 auto s = convert.from(as_byte_string_view(), tag(), alloc, ec);
@@ -4092,8 +4124,8 @@ public:
                 JSONCONS_THROW(key_not_found(name.data(),name.length()));
             case storage_kind::object_value:
             {
-                auto it = object_value().find(name);
-                if (it == object_value().end())
+                auto it = cast<object_storage>().value().find(name);
+                if (it == cast<object_storage>().value().end())
                 {
                     JSONCONS_THROW(key_not_found(name.data(),name.length()));
                 }
@@ -4114,8 +4146,8 @@ public:
                 JSONCONS_THROW(key_not_found(key.data(),key.length()));
             case storage_kind::object_value:
             {
-                auto it = object_value().find(key);
-                if (it == object_value().end())
+                auto it = cast<object_storage>().value().find(key);
+                if (it == cast<object_storage>().value().end())
                 {
                     JSONCONS_THROW(key_not_found(key.data(),key.length()));
                 }
@@ -4135,13 +4167,13 @@ public:
         switch (storage())
         {
             case storage_kind::array_value:
-                if (i >= array_value().size())
+                if (i >= cast<array_storage>().value().size())
                 {
                     JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
                 }
-                return array_value().operator[](i);
+                return cast<array_storage>().value().operator[](i);
             case storage_kind::object_value:
-                return object_value().at(i);
+                return cast<object_storage>().value().at(i);
             default:
                 JSONCONS_THROW(json_runtime_error<std::domain_error>("Index on non-array value not supported"));
         }
@@ -4152,13 +4184,13 @@ public:
         switch (storage())
         {
             case storage_kind::array_value:
-                if (i >= array_value().size())
+                if (i >= cast<array_storage>().value().size())
                 {
                     JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
                 }
-                return array_value().operator[](i);
+                return cast<array_storage>().value().operator[](i);
             case storage_kind::object_value:
-                return object_value().at(i);
+                return cast<object_storage>().value().at(i);
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->at(i);
             default:
@@ -4173,7 +4205,7 @@ public:
             case storage_kind::empty_object_value:
                 return object_range().end();
             case storage_kind::object_value:
-                return object_iterator(object_value().find(name));
+                return object_iterator(cast<object_storage>().value().find(name));
             default:
             {
                 JSONCONS_THROW(not_an_object(name.data(),name.length()));
@@ -4188,7 +4220,7 @@ public:
             case storage_kind::empty_object_value:
                 return object_range().end();
             case storage_kind::object_value:
-                return const_object_iterator(object_value().find(key));
+                return const_object_iterator(cast<object_storage>().value().find(key));
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->find(key);
             default:
@@ -4209,8 +4241,8 @@ public:
             }
             case storage_kind::object_value:
             {
-                auto it = object_value().find(key);
-                if (it != object_value().end())
+                auto it = cast<object_storage>().value().find(key);
+                if (it != cast<object_storage>().value().end())
                 {
                     return it->value();
                 }
@@ -4244,8 +4276,8 @@ public:
             }
             case storage_kind::object_value:
             {
-                auto it = object_value().find(key);
-                if (it != object_value().end())
+                auto it = cast<object_storage>().value().find(key);
+                if (it != cast<object_storage>().value().end())
                 {
                     return it->value().template as<T>();
                 }
@@ -4270,10 +4302,10 @@ public:
         switch (storage())
         {
         case storage_kind::array_value:
-            array_value().shrink_to_fit();
+            cast<array_storage>().value().shrink_to_fit();
             break;
         case storage_kind::object_value:
-            object_value().shrink_to_fit();
+            cast<object_storage>().value().shrink_to_fit();
             break;
         default:
             break;
@@ -4285,10 +4317,10 @@ public:
         switch (storage())
         {
         case storage_kind::array_value:
-            array_value().clear();
+            cast<array_storage>().value().clear();
             break;
         case storage_kind::object_value:
-            object_value().clear();
+            cast<object_storage>().value().clear();
             break;
         default:
             break;
@@ -4302,7 +4334,7 @@ public:
         case storage_kind::empty_object_value:
             break;
         case storage_kind::object_value:
-            object_value().erase(pos);
+            cast<object_storage>().value().erase(pos);
             break;
         default:
             JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
@@ -4317,7 +4349,7 @@ public:
         case storage_kind::empty_object_value:
             break;
         case storage_kind::object_value:
-            object_value().erase(first, last);
+            cast<object_storage>().value().erase(first, last);
             break;
         default:
             JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
@@ -4330,7 +4362,7 @@ public:
         switch (storage())
         {
         case storage_kind::array_value:
-            array_value().erase(pos);
+            cast<array_storage>().value().erase(pos);
             break;
         default:
             JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
@@ -4343,7 +4375,7 @@ public:
         switch (storage())
         {
         case storage_kind::array_value:
-            array_value().erase(first, last);
+            cast<array_storage>().value().erase(first, last);
             break;
         default:
             JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
@@ -4360,7 +4392,7 @@ public:
         case storage_kind::empty_object_value:
             break;
         case storage_kind::object_value:
-            object_value().erase(name);
+            cast<object_storage>().value().erase(name);
             break;
         default:
             JSONCONS_THROW(not_an_object(name.data(),name.length()));
@@ -4378,7 +4410,7 @@ public:
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
         {
-            auto result = object_value().insert_or_assign(name, std::forward<T>(val));
+            auto result = cast<object_storage>().value().insert_or_assign(name, std::forward<T>(val));
             return std::make_pair(object_iterator(result.first), result.second);
         }
         default:
@@ -4398,7 +4430,7 @@ public:
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
         {
-            auto result = object_value().try_emplace(name, std::forward<Args>(args)...);
+            auto result = cast<object_storage>().value().try_emplace(name, std::forward<Args>(args)...);
             return std::make_pair(object_iterator(result.first),result.second);
         }
         default:
@@ -4418,7 +4450,7 @@ public:
             create_object_implicitly();
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            object_value().merge(source.object_value());
+            cast<object_storage>().value().merge(source.object_value());
             break;
         default:
             {
@@ -4435,7 +4467,7 @@ public:
             create_object_implicitly();
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            object_value().merge(std::move(source.object_value()));
+            cast<object_storage>().value().merge(std::move(source.object_value()));
             break;
         default:
             {
@@ -4452,7 +4484,7 @@ public:
             create_object_implicitly();
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            object_value().merge(hint, source.object_value());
+            cast<object_storage>().value().merge(hint, source.object_value());
             break;
         default:
             {
@@ -4469,7 +4501,7 @@ public:
             create_object_implicitly();
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            object_value().merge(hint, std::move(source.object_value()));
+            cast<object_storage>().value().merge(hint, std::move(source.object_value()));
             break;
         default:
             {
@@ -4488,7 +4520,7 @@ public:
             create_object_implicitly();
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            object_value().merge_or_update(source.object_value());
+            cast<object_storage>().value().merge_or_update(source.object_value());
             break;
         default:
             {
@@ -4505,7 +4537,7 @@ public:
             create_object_implicitly();
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            object_value().merge_or_update(std::move(source.object_value()));
+            cast<object_storage>().value().merge_or_update(std::move(source.object_value()));
             break;
         default:
             {
@@ -4522,7 +4554,7 @@ public:
             create_object_implicitly();
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            object_value().merge_or_update(hint, source.object_value());
+            cast<object_storage>().value().merge_or_update(hint, source.object_value());
             break;
         default:
             {
@@ -4539,7 +4571,7 @@ public:
             create_object_implicitly();
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            object_value().merge_or_update(hint, std::move(source.object_value()));
+            cast<object_storage>().value().merge_or_update(hint, std::move(source.object_value()));
             break;
         default:
             {
@@ -4557,7 +4589,7 @@ public:
             create_object_implicitly();
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            return object_iterator(object_value().insert_or_assign(hint, name, std::forward<T>(val)));
+            return object_iterator(cast<object_storage>().value().insert_or_assign(hint, name, std::forward<T>(val)));
         default:
             {
                 JSONCONS_THROW(not_an_object(name.data(),name.length()));
@@ -4574,7 +4606,7 @@ public:
             create_object_implicitly();
             JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            return object_iterator(object_value().try_emplace(hint, name, std::forward<Args>(args)...));
+            return object_iterator(cast<object_storage>().value().try_emplace(hint, name, std::forward<Args>(args)...));
         default:
             {
                 JSONCONS_THROW(not_an_object(name.data(),name.length()));
@@ -4588,7 +4620,7 @@ public:
         switch (storage())
         {
         case storage_kind::array_value:
-            return array_value().insert(pos, std::forward<T>(val));
+            return cast<array_storage>().value().insert(pos, std::forward<T>(val));
             break;
         default:
             {
@@ -4603,7 +4635,7 @@ public:
         switch (storage())
         {
         case storage_kind::array_value:
-            return array_value().insert(pos, first, last);
+            return cast<array_storage>().value().insert(pos, first, last);
             break;
         default:
             {
@@ -4618,8 +4650,10 @@ public:
         switch (storage())
         {
         case storage_kind::empty_object_value:
+            create_object_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            object_value().insert(first, last, get_key_value<key_type,basic_json>());
+            cast<object_storage>().value().insert(first, last, get_key_value<key_type,basic_json>());
             break;
         default:
             {
@@ -4634,8 +4668,10 @@ public:
         switch (storage())
         {
         case storage_kind::empty_object_value:
+            create_object_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_kind::object_value:
-            object_value().insert(tag, first, last, get_key_value<key_type,basic_json>());
+            cast<object_storage>().value().insert(tag, first, last, get_key_value<key_type,basic_json>());
             break;
         default:
             {
@@ -4650,7 +4686,7 @@ public:
         switch (storage())
         {
         case storage_kind::array_value:
-            return array_value().emplace(pos, std::forward<Args>(args)...);
+            return cast<array_storage>().value().emplace(pos, std::forward<Args>(args)...);
             break;
         default:
             {
@@ -4665,7 +4701,7 @@ public:
         switch (storage())
         {
         case storage_kind::array_value:
-            return array_value().emplace_back(std::forward<Args>(args)...);
+            return cast<array_storage>().value().emplace_back(std::forward<Args>(args)...);
         default:
             {
                 JSONCONS_THROW(json_runtime_error<std::domain_error>("Attempting to insert into a value that is not an array"));
@@ -4684,7 +4720,7 @@ public:
         switch (storage())
         {
         case storage_kind::array_value:
-            array_value().push_back(std::forward<T>(val));
+            cast<array_storage>().value().push_back(std::forward<T>(val));
             break;
         default:
             {
@@ -4705,8 +4741,8 @@ public:
             }
             case storage_kind::object_value:
             {
-                auto it = object_value().find(key);
-                if (it != object_value().end())
+                auto it = cast<object_storage>().value().find(key);
+                if (it != cast<object_storage>().value().end())
                 {
                     return it->value().template as<T>();
                 }
@@ -4736,8 +4772,8 @@ public:
             }
             case storage_kind::object_value:
             {
-                auto it = object_value().find(key);
-                if (it != object_value().end())
+                auto it = cast<object_storage>().value().find(key);
+                if (it != cast<object_storage>().value().end())
                 {
                     return it->value().template as<T>();
                 }
@@ -5028,7 +5064,7 @@ public:
     JSONCONS_DEPRECATED_MSG("Instead, use insert(const_array_iterator, T&&)")
     void add(std::size_t index, basic_json&& value)
     {
-        evaluate_with_default().add(index, std::forward<basic_json>(value));
+        evaluate_with_default().add(index, std::move(value));
     }
 
     template <class T>
@@ -5132,8 +5168,8 @@ public:
             }
         case storage_kind::object_value:
             {
-                auto it = object_value().find(name);
-                if (it != object_value().end())
+                auto it = cast<object_storage>().value().find(name);
+                if (it != cast<object_storage>().value().end())
                 {
                     return it->value();
                 }
@@ -5160,8 +5196,8 @@ public:
             return a_null;
         case storage_kind::object_value:
             {
-                auto it = object_value().find(name);
-                return it != object_value().end() ? it->value() : a_null;
+                auto it = cast<object_storage>().value().find(name);
+                return it != cast<object_storage>().value().end() ? it->value() : a_null;
             }
         default:
             {
@@ -5230,7 +5266,7 @@ public:
         switch (storage())
         {
         case storage_kind::array_value:
-            array_value().remove_range(from_index, to_index);
+            cast<array_storage>().value().remove_range(from_index, to_index);
             break;
         default:
             break;
@@ -5299,8 +5335,8 @@ public:
         case storage_kind::empty_object_value:
             return range<object_iterator, const_object_iterator>(object_iterator(), object_iterator());
         case storage_kind::object_value:
-            return range<object_iterator, const_object_iterator>(object_iterator(object_value().begin()),
-                                          object_iterator(object_value().end()));
+            return range<object_iterator, const_object_iterator>(object_iterator(cast<object_storage>().value().begin()),
+                                          object_iterator(cast<object_storage>().value().end()));
         default:
             JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
         }
@@ -5313,8 +5349,8 @@ public:
             case storage_kind::empty_object_value:
                 return range<const_object_iterator, const_object_iterator>(const_object_iterator(), const_object_iterator());
             case storage_kind::object_value:
-                return range<const_object_iterator, const_object_iterator>(const_object_iterator(object_value().begin()),
-                                                    const_object_iterator(object_value().end()));
+                return range<const_object_iterator, const_object_iterator>(const_object_iterator(cast<object_storage>().value().begin()),
+                                                    const_object_iterator(cast<object_storage>().value().end()));
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->object_range();
             default:
@@ -5327,7 +5363,7 @@ public:
         switch (storage())
         {
             case storage_kind::array_value:
-                return range<array_iterator, const_array_iterator>(array_value().begin(),array_value().end());
+                return range<array_iterator, const_array_iterator>(cast<array_storage>().value().begin(),cast<array_storage>().value().end());
             default:
                 JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
         }
@@ -5338,7 +5374,7 @@ public:
         switch (storage())
         {
             case storage_kind::array_value:
-                return range<const_array_iterator, const_array_iterator>(array_value().begin(),array_value().end());
+                return range<const_array_iterator, const_array_iterator>(cast<array_storage>().value().begin(),cast<array_storage>().value().end());
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->array_range();
             default:
@@ -5392,8 +5428,10 @@ public:
         switch (storage())
         {
             case storage_kind::empty_object_value:
-                const_cast<basic_json*>(this)->create_object_implicitly(); // HERE
-                JSONCONS_FALLTHROUGH;
+            {
+                static const object empty_object;
+                return empty_object;
+            }
             case storage_kind::object_value:
                 return cast<object_storage>().value();
             case storage_kind::json_const_pointer:
@@ -5406,9 +5444,22 @@ public:
 
 private:
 
-    void dump_noflush(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+    template <class Visitor>
+    void dump_to(Visitor& visitor, std::error_code& ec) const
     {
+        // One context for the whole walk; dump_noflush recurses per node.
         const ser_context context{};
+        dump_noflush(visitor, context, ec);
+        if (ec)
+        {
+            return;
+        }
+        visitor.flush();
+    }
+
+    template <class Visitor>
+    void dump_noflush(Visitor& visitor, const ser_context& context, std::error_code& ec) const
+    {
         switch (storage())
         {
             case storage_kind::short_string_value:
@@ -5451,14 +5502,14 @@ private:
             case storage_kind::object_value:
             {
                 bool more = visitor.begin_object(size(), tag(), context, ec);
-                const object& o = object_value();
-                for (auto it = o.begin(); more && it != o.end(); ++it)
-                {
-                    visitor.key(string_view_type((it->key()).data(),it->key().length()), context, ec);
-                    it->value().dump_noflush(visitor, ec);
-                }
                 if (more)
                 {
+                    const object& o = cast<object_storage>().value();
+                    for (auto it = o.begin(); it != o.end(); ++it)
+                    {
+                        visitor.key(string_view_type((it->key()).data(),it->key().length()), context, ec);
+                        it->value().dump_noflush(visitor, context, ec);
+                    }
                     visitor.end_object(context, ec);
                 }
                 break;
@@ -5466,19 +5517,19 @@ private:
             case storage_kind::array_value:
             {
                 bool more = visitor.begin_array(size(), tag(), context, ec);
-                const array& o = array_value();
-                for (const_array_iterator it = o.begin(); more && it != o.end(); ++it)
-                {
-                    it->dump_noflush(visitor, ec);
-                }
                 if (more)
                 {
+                    const array& o = cast<array_storage>().value();
+                    for (const_array_iterator it = o.begin(); it != o.end(); ++it)
+                    {
+                        it->dump_noflush(visitor, context, ec);
+                    }
                     visitor.end_array(context, ec);
                 }
                 break;
             }
             case storage_kind::json_const_pointer:
-                return cast<json_const_pointer_storage>().value()->dump_noflush(visitor, ec);
+                return cast<json_const_pointer_storage>().value()->dump_noflush(visitor, context, ec);
             default:
                 break;
         }
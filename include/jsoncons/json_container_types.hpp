@@ -779,27 +779,73 @@ namespace jsoncons {
         template<class InputIt, class Convert>
         void insert(sorted_unique_range_tag, InputIt first, InputIt last, Convert convert)
         {
-            if (first != last)
+            if (first == last)
             {
-                std::size_t count = std::distance(first,last);
-                members_.reserve(members_.size() + count);
-
-                auto it = find(convert(*first).key());
-                if (it != members_.end())
+                return;
+            }
+            std::size_t count = std::distance(first,last);
+            if (members_.empty())
+            {
+                members_.reserve(count);
+                for (auto s = first; s != last; ++s)
                 {
-                    for (auto s = first; s != last; ++s)
-                    {
-                        it = members_.emplace(it, convert(*s));
-                    }
+                    members_.emplace_back(convert(*s));
+                }
+                return;
+            }
+            // The tag guarantees the range is sorted on unique keys, so a
+            // two-cursor merge keeps the container sorted in one linear
+            // pass. An existing member wins over a range entry with the
+            // same key, matching try_emplace.
+            key_value_container_type merged(members_.get_allocator());
+            merged.reserve(members_.size() + count);
+            auto it1 = members_.begin();
+            auto end1 = members_.end();
+            auto s = first;
+            key_value_type kv = convert(*s);
+            bool pending = true;
+            while (it1 != end1 && pending)
+            {
+                int cmp = it1->key().compare(kv.key());
+                if (cmp < 0)
+                {
+                    merged.emplace_back(std::move(*it1));
+                    ++it1;
                 }
                 else
                 {
-                    for (auto s = first; s != last; ++s)
+                    if (cmp > 0)
+                    {
+                        merged.emplace_back(std::move(kv));
+                    }
+                    else
                     {
-                        members_.emplace_back(convert(*s));
+                        merged.emplace_back(std::move(*it1));
+                        ++it1;
                     }
+                    if (++s != last)
+                    {
+                        kv = convert(*s);
+                    }
+                    else
+                    {
+                        pending = false;
+                    }
+                }
+            }
+            for (; it1 != end1; ++it1)
+            {
+                merged.emplace_back(std::move(*it1));
+            }
+            if (pending)
+            {
+                merged.emplace_back(std::move(kv));
+                for (++s; s != last; ++s)
+                {
+                    merged.emplace_back(convert(*s));
                 }
             }
+            members_ = std::move(merged);
         }
 
         // insert_or_assign
@@ -1066,29 +1112,91 @@ namespace jsoncons {
 
         void merge(const json_object& source)
         {
-            for (auto it = source.begin(); it != source.end(); ++it)
+            if (source.empty())
+            {
+                return;
+            }
+            // Both sides are sorted on key, so a single two-cursor pass
+            // builds the union instead of a lower_bound plus mid-vector
+            // insert per source member.
+            key_value_container_type merged(members_.get_allocator());
+            merged.reserve(members_.size() + source.size());
+            auto it1 = members_.begin();
+            auto end1 = members_.end();
+            auto it2 = source.begin();
+            auto end2 = source.end();
+            while (it1 != end1 && it2 != end2)
+            {
+                int cmp = it1->key().compare(it2->key());
+                if (cmp < 0)
+                {
+                    merged.emplace_back(std::move(*it1));
+                    ++it1;
+                }
+                else if (cmp > 0)
+                {
+                    merged.emplace_back(*it2);
+                    ++it2;
+                }
+                else
+                {
+                    merged.emplace_back(std::move(*it1));
+                    ++it1;
+                    ++it2;
+                }
+            }
+            for (; it1 != end1; ++it1)
             {
-                try_emplace(it->key(),it->value());
+                merged.emplace_back(std::move(*it1));
             }
+            for (; it2 != end2; ++it2)
+            {
+                merged.emplace_back(*it2);
+            }
+            members_ = std::move(merged);
         }
 
         void merge(json_object&& source)
         {
-            auto it = std::make_move_iterator(source.begin());
-            auto end = std::make_move_iterator(source.end());
-            for (; it != end; ++it)
+            if (source.empty())
             {
-                auto pos = std::lower_bound(members_.begin(),members_.end(), (*it).key(), 
-                                            [](const key_value_type& a, const string_view_type& k) -> bool {return string_view_type(a.key()).compare(k) < 0;});   
-                if (pos == members_.end() )
+                return;
+            }
+            key_value_container_type merged(members_.get_allocator());
+            merged.reserve(members_.size() + source.size());
+            auto it1 = members_.begin();
+            auto end1 = members_.end();
+            auto it2 = source.members_.begin();
+            auto end2 = source.members_.end();
+            while (it1 != end1 && it2 != end2)
+            {
+                int cmp = it1->key().compare(it2->key());
+                if (cmp < 0)
                 {
-                    members_.emplace_back(*it);
+                    merged.emplace_back(std::move(*it1));
+                    ++it1;
                 }
-                else if ((*it).key() != pos->key())
+                else if (cmp > 0)
+                {
+                    merged.emplace_back(std::move(*it2));
+                    ++it2;
+                }
+                else
                 {
-                    members_.emplace(pos,*it);
+                    merged.emplace_back(std::move(*it1));
+                    ++it1;
+                    ++it2;
                 }
             }
+            for (; it1 != end1; ++it1)
+            {
+                merged.emplace_back(std::move(*it1));
+            }
+            for (; it2 != end2; ++it2)
+            {
+                merged.emplace_back(std::move(*it2));
+            }
+            members_ = std::move(merged);
         }
 
         void merge(iterator hint, const json_object& source)
@@ -1132,29 +1240,89 @@ namespace jsoncons {
 
         void merge_or_update(const json_object& source)
         {
-            for (auto it = source.begin(); it != source.end(); ++it)
+            if (source.empty())
             {
-                insert_or_assign((*it).key(),(*it).value());
+                return;
+            }
+            key_value_container_type merged(members_.get_allocator());
+            merged.reserve(members_.size() + source.size());
+            auto it1 = members_.begin();
+            auto end1 = members_.end();
+            auto it2 = source.begin();
+            auto end2 = source.end();
+            while (it1 != end1 && it2 != end2)
+            {
+                int cmp = it1->key().compare(it2->key());
+                if (cmp < 0)
+                {
+                    merged.emplace_back(std::move(*it1));
+                    ++it1;
+                }
+                else if (cmp > 0)
+                {
+                    merged.emplace_back(*it2);
+                    ++it2;
+                }
+                else
+                {
+                    // On a key collision merge_or_update takes the source value
+                    merged.emplace_back(*it2);
+                    ++it1;
+                    ++it2;
+                }
             }
+            for (; it1 != end1; ++it1)
+            {
+                merged.emplace_back(std::move(*it1));
+            }
+            for (; it2 != end2; ++it2)
+            {
+                merged.emplace_back(*it2);
+            }
+            members_ = std::move(merged);
         }
 
         void merge_or_update(json_object&& source)
         {
-            auto it = std::make_move_iterator(source.begin());
-            auto end = std::make_move_iterator(source.end());
-            for (; it != end; ++it)
+            if (source.empty())
             {
-                auto pos = std::lower_bound(members_.begin(),members_.end(), (*it).key(), 
-                                            [](const key_value_type& a, const string_view_type& k) -> bool {return string_view_type(a.key()).compare(k) < 0;});   
-                if (pos == members_.end() )
+                return;
+            }
+            key_value_container_type merged(members_.get_allocator());
+            merged.reserve(members_.size() + source.size());
+            auto it1 = members_.begin();
+            auto end1 = members_.end();
+            auto it2 = source.members_.begin();
+            auto end2 = source.members_.end();
+            while (it1 != end1 && it2 != end2)
+            {
+                int cmp = it1->key().compare(it2->key());
+                if (cmp < 0)
                 {
-                    members_.emplace_back(*it);
+                    merged.emplace_back(std::move(*it1));
+                    ++it1;
                 }
-                else 
+                else if (cmp > 0)
                 {
-                    pos->value((*it).value());
+                    merged.emplace_back(std::move(*it2));
+                    ++it2;
+                }
+                else
+                {
+                    merged.emplace_back(std::move(*it2));
+                    ++it1;
+                    ++it2;
                 }
             }
+            for (; it1 != end1; ++it1)
+            {
+                merged.emplace_back(std::move(*it1));
+            }
+            for (; it2 != end2; ++it2)
+            {
+                merged.emplace_back(std::move(*it2));
+            }
+            members_ = std::move(merged);
         }
 
         void merge_or_update(iterator hint, const json_object& source)
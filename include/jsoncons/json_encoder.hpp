@@ -47,8 +47,29 @@ namespace detail {
         std::size_t count = 0;
         const CharT* begin = s;
         const CharT* end = s + length;
+        const bool scan_runs = !escape_all_non_ascii && !escape_solidus;
         for (const CharT* it = begin; it != end; ++it)
         {
+            if (scan_runs)
+            {
+                // With the default options only control characters, '"' and
+                // '\\' need escaping, so find the end of the clean run and
+                // emit it in one append instead of a push_back per character.
+                const CharT* run = it;
+                while (it != end && !is_control_character(static_cast<uint32_t>(*it)) && *it != '"' && *it != '\\')
+                {
+                    ++it;
+                }
+                if (it != run)
+                {
+                    sink.append(run, static_cast<std::size_t>(it - run));
+                    count += static_cast<std::size_t>(it - run);
+                }
+                if (it == end)
+                {
+                    break;
+                }
+            }
             CharT c = *it;
             switch (c)
             {
@@ -508,6 +508,7 @@ private:
     typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<csv_parse_state> csv_parse_state_allocator_type;
 
     static constexpr int default_depth = 3;
+    static constexpr std::size_t default_buffer_capacity = 64;
 
     temp_allocator_type alloc_;
     csv_parse_state state_;
@@ -517,6 +518,13 @@ private:
     std::size_t line_;
     int depth_;
     const basic_csv_decode_options<CharT> options_;
+    const mapping_kind mapping_;
+    const bool infer_types_;
+    const bool lossless_number_;
+    const bool ignore_empty_values_;
+    const bool unquoted_empty_value_is_null_;
+    const bool trim_leading_inside_quotes_;
+    const bool trim_trailing_inside_quotes_;
     std::size_t column_index_;
     std::size_t level_;
     std::size_t offset_;
@@ -534,6 +542,7 @@ private:
     std::vector<string_type,string_allocator_type> column_defaults_;
     std::vector<csv_parse_state,csv_parse_state_allocator_type> state_stack_;
     string_type buffer_;
+    std::vector<std::pair<bool,basic_json<CharT,preserve_order_policy>>> cached_column_defaults_;
     std::vector<std::pair<string_view_type,double>> string_double_map_;
 
 public:
@@ -567,6 +576,13 @@ public:
          visitor_(nullptr),
          err_handler_(err_handler),
          options_(options),
+         mapping_(options.mapping()),
+         infer_types_(options.infer_types()),
+         lossless_number_(options.lossless_number()),
+         ignore_empty_values_(options.ignore_empty_values()),
+         unquoted_empty_value_is_null_(options.unquoted_empty_value_is_null()),
+         trim_leading_inside_quotes_(options.trim_leading_inside_quotes()),
+         trim_trailing_inside_quotes_(options.trim_trailing_inside_quotes()),
          level_(0),
          offset_(0),
          begin_input_(nullptr),
@@ -583,11 +599,13 @@ public:
          buffer_(alloc)
     {
         depth_ = default_depth;
+        buffer_.reserve(default_buffer_capacity);
         state_ = csv_parse_state::start;
         line_ = 1;
         column_ = 1;
         column_index_ = 0;
         stack_.reserve(default_depth);
+        state_stack_.reserve(default_depth);
         if (options_.enable_str_to_nan())
         {
             string_double_map_.emplace_back(options_.nan_to_str(),std::nan(""));
@@ -605,6 +623,7 @@ public:
         jsoncons::csv::detail::parse_column_names(options.column_names(), column_names_);
         jsoncons::csv::detail::parse_column_types(options.column_types(), column_types_);
         jsoncons::csv::detail::parse_column_names(options.column_defaults(), column_defaults_);
+        cached_column_defaults_.resize(column_defaults_.size());
 
         if (options_.header_lines() > 0)
         {
@@ -667,7 +686,7 @@ public:
 
     void parse_some(basic_json_visitor<CharT>& visitor, std::error_code& ec)
     {
-        switch (options_.mapping())
+        switch (mapping_)
         {
             case mapping_kind::m_columns:
                 visitor_ = &m_columns_filter_;
@@ -679,6 +698,20 @@ public:
 
         const CharT* local_input_end = input_end_;
 
+        // The option accessors are loop-invariant; read them once so the
+        // compiler can keep them in registers across the visitor calls
+        // below instead of reloading members after every opaque call.
+        const CharT field_delimiter = options_.field_delimiter();
+        const CharT subfield_delimiter = options_.subfield_delimiter();
+        const CharT quote_char = options_.quote_char();
+        const CharT quote_escape_char = options_.quote_escape_char();
+        const CharT comment_starter = options_.comment_starter();
+        const bool trim_leading = options_.trim_leading();
+        const bool trim_trailing = options_.trim_trailing();
+        const bool ignore_empty_values = ignore_empty_values_;
+        const bool ignore_empty_lines = options_.ignore_empty_lines();
+        const std::size_t max_lines = options_.max_lines();
+
         if (input_ptr_ == local_input_end && more_)
         {
             switch (state_)
@@ -705,11 +738,11 @@ public:
                     buffer_.clear();
                     JSONCONS_FALLTHROUGH;
                 case csv_parse_state::unquoted_string: 
-                    if (options_.trim_leading() || options_.trim_trailing())
+                    if (trim_leading || trim_trailing)
                     {
-                        trim_string_buffer(options_.trim_leading(),options_.trim_trailing());
+                        trim_string_buffer(trim_leading,trim_trailing);
                     }
-                    if (options_.ignore_empty_values() && buffer_.empty())
+                    if (ignore_empty_values && buffer_.empty())
                     {
                         state_ = csv_parse_state::end_record;
                     }
@@ -725,9 +758,9 @@ public:
                     state_ = csv_parse_state::end_record;
                     break;
                 case csv_parse_state::escaped_value:
-                    if (options_.quote_escape_char() == options_.quote_char())
+                    if (quote_escape_char == quote_char)
                     {
-                        if (!(options_.ignore_empty_values() && buffer_.empty()))
+                        if (!(ignore_empty_values && buffer_.empty()))
                         {
                             before_value(ec);
                             ++column_;
@@ -765,7 +798,7 @@ public:
                             break;
                     }
                     more_ = visitor_->end_array(*this, ec);
-                    if (options_.mapping() == mapping_kind::m_columns)
+                    if (mapping_ == mapping_kind::m_columns)
                     {
                         if (!m_columns_filter_.done())
                         {
@@ -821,11 +854,11 @@ public:
                     }
                     break;
                 case csv_parse_state::start:
-                    if (options_.mapping() != mapping_kind::m_columns)
+                    if (mapping_ != mapping_kind::m_columns)
                     {
                         more_ = visitor_->begin_array(semantic_tag::none, *this, ec);
                     }
-                    if (options_.assume_header() && options_.mapping() == mapping_kind::n_rows && options_.column_names().size() > 0)
+                    if (options_.assume_header() && mapping_ == mapping_kind::n_rows && options_.column_names().size() > 0)
                     {
                         column_index_ = 0;
                         state_ = csv_parse_state::column_labels;
@@ -838,20 +871,40 @@ public:
                     }
                     break;
                 case csv_parse_state::column_labels:
-                    if (column_index_ < column_names_.size())
+                    // Replay all the labels in one pass instead of taking a
+                    // trip through the state machine per label. A visitor
+                    // that pauses leaves column_index_ where it stopped so
+                    // the state resumes mid-list.
+                    while (column_index_ < column_names_.size() && more_)
                     {
                         more_ = visitor_->string_value(column_names_[column_index_], semantic_tag::none, *this, ec);
                         ++column_index_;
                     }
-                    else
+                    if (more_ && column_index_ >= column_names_.size())
                     {
                         more_ = visitor_->end_array(*this, ec);
-                        state_ = csv_parse_state::expect_comment_or_record; 
+                        state_ = csv_parse_state::expect_comment_or_record;
                         //stack_.back() = csv_mode::data;
                         column_index_ = 0;
                     }
                     break;
-                case csv_parse_state::comment: 
+                case csv_parse_state::comment:
+                    // Skip the comment body to the line terminator in one
+                    // scan; only the terminator needs the switch below.
+                    {
+                        const CharT* p = input_ptr_;
+                        while (p < local_input_end && *p != '\n' && *p != '\r')
+                        {
+                            ++p;
+                        }
+                        column_ += static_cast<std::size_t>(p - input_ptr_);
+                        input_ptr_ = p;
+                        if (p == local_input_end)
+                        {
+                            break;
+                        }
+                        curr_char = *p;
+                    }
                     switch (curr_char)
                     {
                         case '\n':
@@ -885,7 +938,7 @@ public:
                 
                 case csv_parse_state::expect_comment_or_record:
                     buffer_.clear();
-                    if (curr_char == options_.comment_starter())
+                    if (curr_char == comment_starter)
                     {
                         state_ = csv_parse_state::comment;
                         ++column_;
@@ -896,13 +949,33 @@ public:
                         state_ = csv_parse_state::expect_record;
                     }
                     break;
-                case csv_parse_state::quoted_string: 
+                case csv_parse_state::quoted_string:
                     {
-                        if (curr_char == options_.quote_escape_char())
+                        // Everything up to the quote or escape character is
+                        // passed through verbatim, so consume the run in one
+                        // scan and one append rather than per character.
+                        const CharT* run_begin = input_ptr_;
+                        const CharT* p = input_ptr_;
+                        while (p < local_input_end && *p != quote_escape_char && *p != quote_char)
+                        {
+                            ++p;
+                        }
+                        if (p != run_begin)
+                        {
+                            buffer_.append(run_begin, static_cast<std::size_t>(p - run_begin));
+                            column_ += static_cast<std::size_t>(p - run_begin);
+                            input_ptr_ = p;
+                            if (p == local_input_end)
+                            {
+                                break;
+                            }
+                            curr_char = *p;
+                        }
+                        if (curr_char == quote_escape_char)
                         {
                             state_ = csv_parse_state::escaped_value;
                         }
-                        else if (curr_char == options_.quote_char())
+                        else if (curr_char == quote_char)
                         {
                             state_ = csv_parse_state::between_values;
                         }
@@ -910,20 +983,20 @@ public:
                         {
                             buffer_.push_back(static_cast<CharT>(curr_char));
                         }
+                        ++column_;
+                        ++input_ptr_;
                     }
-                    ++column_;
-                    ++input_ptr_;
                     break;
                 case csv_parse_state::escaped_value: 
                     {
-                        if (curr_char == options_.quote_char())
+                        if (curr_char == quote_char)
                         {
                             buffer_.push_back(static_cast<CharT>(curr_char));
                             state_ = csv_parse_state::quoted_string;
                             ++column_;
                             ++input_ptr_;
                         }
-                        else if (options_.quote_escape_char() == options_.quote_char())
+                        else if (quote_escape_char == quote_char)
                         {
                             state_ = csv_parse_state::between_values;
                         }
@@ -941,11 +1014,11 @@ public:
                         case '\r':
                         case '\n':
                         {
-                            if (options_.trim_leading() || options_.trim_trailing())
+                            if (trim_leading || trim_trailing)
                             {
-                                trim_string_buffer(options_.trim_leading(),options_.trim_trailing());
+                                trim_string_buffer(trim_leading,trim_trailing);
                             }
-                            if (!(options_.ignore_empty_values() && buffer_.empty()))
+                            if (!(ignore_empty_values && buffer_.empty()))
                             {
                                 before_value(ec);
                                 state_ = csv_parse_state::before_last_quoted_field;
@@ -957,20 +1030,20 @@ public:
                             break;
                         }
                         default:
-                            if (curr_char == options_.field_delimiter())
+                            if (curr_char == field_delimiter)
                             {
-                                if (options_.trim_leading() || options_.trim_trailing())
+                                if (trim_leading || trim_trailing)
                                 {
-                                    trim_string_buffer(options_.trim_leading(),options_.trim_trailing());
+                                    trim_string_buffer(trim_leading,trim_trailing);
                                 }
                                 before_value(ec);
                                 state_ = csv_parse_state::before_quoted_field;
                             }
-                            else if (options_.subfield_delimiter() != char_type() && curr_char == options_.subfield_delimiter())
+                            else if (subfield_delimiter != char_type() && curr_char == subfield_delimiter)
                             {
-                                if (options_.trim_leading() || options_.trim_trailing())
+                                if (trim_leading || trim_trailing)
                                 {
-                                    trim_string_buffer(options_.trim_leading(),options_.trim_trailing());
+                                    trim_string_buffer(trim_leading,trim_trailing);
                                 }
                                 before_value(ec);
                                 state_ = csv_parse_state::before_quoted_subfield;
@@ -1007,7 +1080,8 @@ public:
                         more_ = visitor_->end_array(*this, ec);
                     }
                     ++column_index_;
-                    state_ = csv_parse_state::before_unquoted_string;
+                    buffer_.clear();
+                    state_ = csv_parse_state::unquoted_string;
                     ++column_;
                     ++input_ptr_;
                     break;
@@ -1049,6 +1123,9 @@ public:
                     state_ = csv_parse_state::before_unquoted_subfield_tail;
                     break; 
                 case csv_parse_state::before_unquoted_subfield_tail:
+                    // The pending string_value event views buffer_, so the
+                    // clear must wait for the next parse_some call; route
+                    // through before_unquoted_string rather than clearing here.
                     end_unquoted_string_value(ec);
                     state_ = csv_parse_state::before_unquoted_string;
                     ++column_;
@@ -1067,6 +1144,8 @@ public:
                     state_ = csv_parse_state::before_quoted_subfield_tail;
                     break; 
                 case csv_parse_state::before_quoted_subfield_tail:
+                    // As above: the just-emitted string event may still view
+                    // buffer_, so defer the clear to before_unquoted_string.
                     end_quoted_string_value(ec);
                     state_ = csv_parse_state::before_unquoted_string;
                     ++column_;
@@ -1085,18 +1164,42 @@ public:
                     ++column_index_;
                     state_ = csv_parse_state::end_record;
                     break;
-                case csv_parse_state::unquoted_string: 
+                case csv_parse_state::unquoted_string:
                 {
+                    // Consume the run of ordinary characters in one step. The
+                    // tight scan below compiles to a vectorizable loop, and the
+                    // run is appended to the buffer in a single call instead of
+                    // one push_back per character. The switch that follows only
+                    // ever sees a terminating character.
+                    const CharT* run_begin = input_ptr_;
+                    const CharT* p = input_ptr_;
+                    while (p < local_input_end && *p != '\n' && *p != '\r' &&
+                           *p != field_delimiter && *p != quote_char &&
+                           !(subfield_delimiter != char_type() && *p == subfield_delimiter))
+                    {
+                        ++p;
+                    }
+                    if (p != run_begin)
+                    {
+                        buffer_.append(run_begin, static_cast<std::size_t>(p - run_begin));
+                        column_ += static_cast<std::size_t>(p - run_begin);
+                        input_ptr_ = p;
+                        if (p == local_input_end)
+                        {
+                            break;
+                        }
+                        curr_char = *p;
+                    }
                     switch (curr_char)
                     {
                         case '\n':
                         case '\r':
                         {
-                            if (options_.trim_leading() || options_.trim_trailing())
+                            if (trim_leading || trim_trailing)
                             {
-                                trim_string_buffer(options_.trim_leading(),options_.trim_trailing());
+                                trim_string_buffer(trim_leading,trim_trailing);
                             }
-                            if (!(options_.ignore_empty_values() && buffer_.empty()))
+                            if (!(ignore_empty_values && buffer_.empty()))
                             {
                                 before_value(ec);
                                 state_ = csv_parse_state::before_last_unquoted_field;
@@ -1108,25 +1211,25 @@ public:
                             break;
                         }
                         default:
-                            if (curr_char == options_.field_delimiter())
+                            if (curr_char == field_delimiter)
                             {
-                                if (options_.trim_leading() || options_.trim_trailing())
+                                if (trim_leading || trim_trailing)
                                 {
-                                    trim_string_buffer(options_.trim_leading(),options_.trim_trailing());
+                                    trim_string_buffer(trim_leading,trim_trailing);
                                 }
                                 before_value(ec);
                                 state_ = csv_parse_state::before_unquoted_field;
                             }
-                            else if (options_.subfield_delimiter() != char_type() && curr_char == options_.subfield_delimiter())
+                            else if (subfield_delimiter != char_type() && curr_char == subfield_delimiter)
                             {
-                                if (options_.trim_leading() || options_.trim_trailing())
+                                if (trim_leading || trim_trailing)
                                 {
-                                    trim_string_buffer(options_.trim_leading(),options_.trim_trailing());
+                                    trim_string_buffer(trim_leading,trim_trailing);
                                 }
                                 before_value(ec);
                                 state_ = csv_parse_state::before_unquoted_subfield;
                             }
-                            else if (curr_char == options_.quote_char())
+                            else if (curr_char == quote_char)
                             {
                                 buffer_.clear();
                                 state_ = csv_parse_state::quoted_string;
@@ -1149,7 +1252,7 @@ public:
                     {
                         case '\n':
                         {
-                            if (!options_.ignore_empty_lines())
+                            if (!ignore_empty_lines)
                             {
                                 before_record(ec);
                                 state_ = csv_parse_state::end_record;
@@ -1164,7 +1267,7 @@ public:
                             break;
                         }
                         case '\r':
-                            if (!options_.ignore_empty_lines())
+                            if (!ignore_empty_lines)
                             {
                                 before_record(ec);
                                 state_ = csv_parse_state::end_record;
@@ -1181,7 +1284,7 @@ public:
                             break;
                         case ' ':
                         case '\t':
-                            if (!options_.trim_leading())
+                            if (!trim_leading)
                             {
                                 buffer_.push_back(static_cast<CharT>(curr_char));
                                 before_record(ec);
@@ -1192,7 +1295,7 @@ public:
                             break;
                         default:
                             before_record(ec);
-                            if (curr_char == options_.quote_char())
+                            if (curr_char == quote_char)
                             {
                                 buffer_.clear();
                                 state_ = csv_parse_state::quoted_string;
@@ -1248,7 +1351,7 @@ public:
                     more_ = false;
                     return;
             }
-            if (line_ > options_.max_lines())
+            if (line_ > max_lines)
             {
                 state_ = csv_parse_state::done;
                 more_ = false;
@@ -1307,23 +1410,23 @@ private:
         switch (stack_.back())
         {
             case csv_mode::header:
-                if (options_.trim_leading_inside_quotes() || options_.trim_trailing_inside_quotes())
+                if (trim_leading_inside_quotes_ || trim_trailing_inside_quotes_)
                 {
-                    trim_string_buffer(options_.trim_leading_inside_quotes(),options_.trim_trailing_inside_quotes());
+                    trim_string_buffer(trim_leading_inside_quotes_,trim_trailing_inside_quotes_);
                 }
                 if (line_ == header_line_)
                 {
                     column_names_.push_back(buffer_);
-                    if (options_.assume_header() && options_.mapping() == mapping_kind::n_rows)
+                    if (options_.assume_header() && mapping_ == mapping_kind::n_rows)
                     {
                         more_ = visitor_->string_value(buffer_, semantic_tag::none, *this, ec);
                     }
                 }
                 break;
             case csv_mode::data:
-                if (options_.mapping() == mapping_kind::n_objects)
+                if (mapping_ == mapping_kind::n_objects)
                 {
-                    if (!(options_.ignore_empty_values() && buffer_.empty()))
+                    if (!(ignore_empty_values_ && buffer_.empty()))
                     {
                         if (column_index_ < column_names_.size() + offset_)
                         {
@@ -1347,14 +1450,14 @@ private:
             case csv_mode::header:
                 if (options_.assume_header() && line_ == header_line_)
                 {
-                    if (options_.mapping() == mapping_kind::n_rows)
+                    if (mapping_ == mapping_kind::n_rows)
                     {
                         more_ = visitor_->begin_array(semantic_tag::none, *this, ec);
                     }
                 }
                 break;
             case csv_mode::data:
-                switch (options_.mapping())
+                switch (mapping_)
                 {
                     case mapping_kind::n_rows:
                         more_ = visitor_->begin_array(semantic_tag::none, *this, ec);
@@ -1391,7 +1494,7 @@ private:
                 {
                     stack_.back() = csv_mode::data;
                 }
-                switch (options_.mapping())
+                switch (mapping_)
                 {
                     case mapping_kind::n_rows:
                         if (options_.assume_header())
@@ -1409,7 +1512,7 @@ private:
             case csv_mode::data:
             case csv_mode::subfields:
             {
-                switch (options_.mapping())
+                switch (mapping_)
                 {
                     case mapping_kind::n_rows:
                         more_ = visitor_->end_array(*this, ec);
@@ -1463,10 +1566,22 @@ private:
                 }
             }
         }
-        if (start != 0 || length != buffer_.size())
+        // Trim in place; substr would allocate a temporary per trimmed field.
+        if (length != buffer_.size())
         {
-            buffer_ = buffer_.substr(start,length-start);
+            buffer_.erase(length);
         }
+        if (start != 0)
+        {
+            buffer_.erase(0, start);
+        }
+    }
+
+    // Whitespace per the classic locale, stated directly so the test is
+    // well-defined for negative char values and wide characters alike.
+    static bool is_ascii_space(CharT c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
     }
 
     /*
@@ -1478,49 +1593,49 @@ private:
         {
             case csv_mode::data:
             case csv_mode::subfields:
-                switch (options_.mapping())
+                switch (mapping_)
                 {
                 case mapping_kind::n_rows:
-                    if (options_.unquoted_empty_value_is_null() && buffer_.length() == 0)
+                    if (unquoted_empty_value_is_null_ && buffer_.length() == 0)
                     {
                         more_ = visitor_->null_value(semantic_tag::none, *this, ec);
                     }
                     else
                     {
-                        end_value(options_.infer_types(), ec);
+                        end_value(infer_types_, ec);
                     }
                     break;
                 case mapping_kind::n_objects:
-                    if (!(options_.ignore_empty_values() && buffer_.empty()))
+                    if (!(ignore_empty_values_ && buffer_.empty()))
                     {
                         if (column_index_ < column_names_.size() + offset_)
                         {
-                            if (options_.unquoted_empty_value_is_null() && buffer_.length() == 0)
+                            if (unquoted_empty_value_is_null_ && buffer_.length() == 0)
                             {
                                 more_ = visitor_->null_value(semantic_tag::none, *this, ec);
                             }
                             else
                             {
-                                end_value(options_.infer_types(), ec);
+                                end_value(infer_types_, ec);
                             }
                         }
                         else if (level_ > 0)
                         {
-                            if (options_.unquoted_empty_value_is_null() && buffer_.length() == 0)
+                            if (unquoted_empty_value_is_null_ && buffer_.length() == 0)
                             {
                                 more_ = visitor_->null_value(semantic_tag::none, *this, ec);
                             }
                             else
                             {
-                                end_value(options_.infer_types(), ec);
+                                end_value(infer_types_, ec);
                             }
                         }
                     }
                     break;
                 case mapping_kind::m_columns:
-                    if (!(options_.ignore_empty_values() && buffer_.empty()))
+                    if (!(ignore_empty_values_ && buffer_.empty()))
                     {
-                        end_value(options_.infer_types(), ec);
+                        end_value(infer_types_, ec);
                     }
                     else
                     {
@@ -1540,21 +1655,21 @@ private:
         {
             case csv_mode::data:
             case csv_mode::subfields:
-                if (options_.trim_leading_inside_quotes() || options_.trim_trailing_inside_quotes())
+                if (trim_leading_inside_quotes_ || trim_trailing_inside_quotes_)
                 {
-                    trim_string_buffer(options_.trim_leading_inside_quotes(),options_.trim_trailing_inside_quotes());
+                    trim_string_buffer(trim_leading_inside_quotes_,trim_trailing_inside_quotes_);
                 }
-                switch (options_.mapping())
+                switch (mapping_)
                 {
                 case mapping_kind::n_rows:
                     end_value(false, ec);
                     break;
                 case mapping_kind::n_objects:
-                    if (!(options_.ignore_empty_values() && buffer_.empty()))
+                    if (!(ignore_empty_values_ && buffer_.empty()))
                     {
                         if (column_index_ < column_names_.size() + offset_)
                         {
-                            if (options_.unquoted_empty_value_is_null() && buffer_.length() == 0)
+                            if (unquoted_empty_value_is_null_ && buffer_.length() == 0)
                             {
                                 more_ = visitor_->null_value(semantic_tag::none, *this, ec);
                             }
@@ -1565,7 +1680,7 @@ private:
                         }
                         else if (level_ > 0)
                         {
-                            if (options_.unquoted_empty_value_is_null() && buffer_.length() == 0)
+                            if (unquoted_empty_value_is_null_ && buffer_.length() == 0)
                             {
                                 more_ = visitor_->null_value(semantic_tag::none, *this, ec);
                             }
@@ -1577,7 +1692,7 @@ private:
                     }
                     break;
                 case mapping_kind::m_columns:
-                    if (!(options_.ignore_empty_values() && buffer_.empty()))
+                    if (!(ignore_empty_values_ && buffer_.empty()))
                     {
                         end_value(false, ec);
                     }
@@ -1593,6 +1708,28 @@ private:
         }
     }
 
+    // Replays the default value for column i through the visitor. The
+    // defaults are fixed at construction, so each one is parsed at most
+    // once and replayed from the cached json thereafter instead of
+    // constructing a fresh basic_json_parser per rejected cell. The
+    // cache preserves order so object-valued defaults replay their
+    // members as written, just as streaming the text each time did.
+    void replay_column_default(std::size_t i)
+    {
+        std::pair<bool,basic_json<CharT,preserve_order_policy>>& entry = cached_column_defaults_[i];
+        if (!entry.first)
+        {
+            json_decoder<basic_json<CharT,preserve_order_policy>> decoder;
+            basic_json_parser<CharT,temp_allocator_type> parser(alloc_);
+            parser.update(column_defaults_[i].data(),column_defaults_[i].length());
+            parser.parse_some(decoder);
+            parser.finish_parse(decoder);
+            entry.second = decoder.get_result();
+            entry.first = true;
+        }
+        entry.second.dump(*visitor_);
+    }
+
     void end_value(bool infer_types, std::error_code&  ec)
     {
         auto it = std::find_if(string_double_map_.begin(), string_double_map_.end(), string_maps_to_double{ buffer_ });
@@ -1628,21 +1765,55 @@ private:
             {
                 case csv_column_type::integer_t:
                     {
-                        std::basic_istringstream<CharT,std::char_traits<CharT>,char_allocator_type> iss{buffer_};
-                        int64_t val;
-                        iss >> val;
-                        if (!iss.fail())
+                        // Parse in place instead of routing through an
+                        // istringstream, which allocates per cell. The stream
+                        // extractor tolerated surrounding whitespace, an
+                        // optional '+' and zero padding, so strip those and
+                        // hand to_integer_decimal the bare digit run, applying
+                        // the sign the same way the signed overload does.
+                        const CharT* s = buffer_.data();
+                        const CharT* send = s + buffer_.length();
+                        while (s < send && is_ascii_space(*s))
                         {
-                            more_ = visitor_->int64_value(val, semantic_tag::none, *this, ec);
+                            ++s;
                         }
-                        else
+                        while (send > s && is_ascii_space(send[-1]))
+                        {
+                            --send;
+                        }
+                        bool is_negative = false;
+                        if (s < send && (*s == '+' || *s == '-'))
+                        {
+                            is_negative = *s == '-';
+                            ++s;
+                        }
+                        while ((send - s) > 1 && *s == '0')
+                        {
+                            ++s;
+                        }
+                        bool done = false;
+                        auto result = jsoncons::detail::to_integer_decimal<uint64_t>(s, static_cast<std::size_t>(send - s));
+                        if (result)
+                        {
+                            if (is_negative)
+                            {
+                                if (result.value() <= static_cast<uint64_t>(-((jsoncons::detail::integer_limits<int64_t>::lowest)()+int64_t(1))) + uint64_t(1))
+                                {
+                                    more_ = visitor_->int64_value(static_cast<int64_t>(uint64_t(0) - result.value()), semantic_tag::none, *this, ec);
+                                    done = true;
+                                }
+                            }
+                            else if (result.value() <= static_cast<uint64_t>((jsoncons::detail::integer_limits<int64_t>::max)()))
+                            {
+                                more_ = visitor_->int64_value(static_cast<int64_t>(result.value()), semantic_tag::none, *this, ec);
+                                done = true;
+                            }
+                        }
+                        if (!done)
                         {
                             if (column_index_ - offset_ < column_defaults_.size() && column_defaults_[column_index_ - offset_].length() > 0)
                             {
-                                basic_json_parser<CharT,temp_allocator_type> parser(alloc_);
-                                parser.update(column_defaults_[column_index_ - offset_].data(),column_defaults_[column_index_ - offset_].length());
-                                parser.parse_some(*visitor_);
-                                parser.finish_parse(*visitor_);
+                                replay_column_default(column_index_ - offset_);
                             }
                             else
                             {
@@ -1653,7 +1824,7 @@ private:
                     break;
                 case csv_column_type::float_t:
                     {
-                        if (options_.lossless_number())
+                        if (lossless_number_)
                         {
                             more_ = visitor_->string_value(buffer_,semantic_tag::bigdec, *this, ec);
                         }
@@ -1693,11 +1864,11 @@ private:
                         {
                             more_ = visitor_->bool_value(true, semantic_tag::none, *this, ec);
                         }
-                        else if (buffer_.length() == 5 && ((buffer_[0] == 'f' || buffer_[0] == 'F') && (buffer_[1] == 'a' || buffer_[1] == 'A') && (buffer_[2] == 'l' || buffer_[2] == 'L') && (buffer_[3] == 's' || buffer_[3] == 'S') && (buffer_[4] == 'e' || buffer_[4] == 'E')))
+                        else if (buffer_.length() == 5 && (buffer_[0] | 0x20) == 'f' && (buffer_[1] | 0x20) == 'a' && (buffer_[2] | 0x20) == 'l' && (buffer_[3] | 0x20) == 's' && (buffer_[4] | 0x20) == 'e')
                         {
                             more_ = visitor_->bool_value(false, semantic_tag::none, *this, ec);
                         }
-                        else if (buffer_.length() == 4 && ((buffer_[0] == 't' || buffer_[0] == 'T') && (buffer_[1] == 'r' || buffer_[1] == 'R') && (buffer_[2] == 'u' || buffer_[2] == 'U') && (buffer_[3] == 'e' || buffer_[3] == 'E')))
+                        else if (buffer_.length() == 4 && (buffer_[0] | 0x20) == 't' && (buffer_[1] | 0x20) == 'r' && (buffer_[2] | 0x20) == 'u' && (buffer_[3] | 0x20) == 'e')
                         {
                             more_ = visitor_->bool_value(true, semantic_tag::none, *this, ec);
                         }
@@ -1705,10 +1876,7 @@ private:
                         {
                             if (column_index_ - offset_ < column_defaults_.size() && column_defaults_[column_index_ - offset_].length() > 0)
                             {
-                                basic_json_parser<CharT,temp_allocator_type> parser(alloc_);
-                                parser.update(column_defaults_[column_index_ - offset_].data(),column_defaults_[column_index_ - offset_].length());
-                                parser.parse_some(*visitor_);
-                                parser.finish_parse(*visitor_);
+                                replay_column_default(column_index_ - offset_);
                             }
                             else
                             {
@@ -1726,10 +1894,7 @@ private:
                     {
                         if (column_index_ < column_defaults_.size() + offset_ && column_defaults_[column_index_ - offset_].length() > 0)
                         {
-                            basic_json_parser<CharT,temp_allocator_type> parser(alloc_);
-                            parser.update(column_defaults_[column_index_ - offset_].data(),column_defaults_[column_index_ - offset_].length());
-                            parser.parse_some(*visitor_);
-                            parser.finish_parse(*visitor_);
+                            replay_column_default(column_index_ - offset_);
                         }
                         else
                         {
@@ -1780,7 +1945,6 @@ private:
 
         auto last = buffer_.end();
 
-        std::string buffer;
         for (auto p = buffer_.begin(); state != numeric_check_state::done && p != last; ++p)
         {
             switch (state)
@@ -1790,7 +1954,7 @@ private:
                     switch (*p)
                     {
                     case 'n':case 'N':
-                        if ((last-p) == 4 && (p[1] == 'u' || p[1] == 'U') && (p[2] == 'l' || p[2] == 'L') && (p[3] == 'l' || p[3] == 'L'))
+                        if ((last-p) == 4 && (p[1] | 0x20) == 'u' && (p[2] | 0x20) == 'l' && (p[3] | 0x20) == 'l')
                         {
                             state = numeric_check_state::null;
                         }
@@ -1800,7 +1964,7 @@ private:
                         }
                         break;
                     case 't':case 'T':
-                        if ((last-p) == 4 && (p[1] == 'r' || p[1] == 'R') && (p[2] == 'u' || p[2] == 'U') && (p[3] == 'e' || p[3] == 'U'))
+                        if ((last-p) == 4 && (p[1] | 0x20) == 'r' && (p[2] | 0x20) == 'u' && (p[3] | 0x20) == 'e')
                         {
                             state = numeric_check_state::boolean_true;
                         }
@@ -1810,7 +1974,7 @@ private:
                         }
                         break;
                     case 'f':case 'F':
-                        if ((last-p) == 5 && (p[1] == 'a' || p[1] == 'A') && (p[2] == 'l' || p[2] == 'L') && (p[3] == 's' || p[3] == 'S') && (p[4] == 'e' || p[4] == 'E'))
+                        if ((last-p) == 5 && (p[1] | 0x20) == 'a' && (p[2] | 0x20) == 'l' && (p[3] | 0x20) == 's' && (p[4] | 0x20) == 'e')
                         {
                             state = numeric_check_state::boolean_false;
                         }
@@ -1821,17 +1985,14 @@ private:
                         break;
                     case '-':
                         is_negative = true;
-                        buffer.push_back(*p);
                         state = numeric_check_state::minus;
                         break;
                     case '0':
                         ++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::zero;
                         break;
                     case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::integer;
                         break;
                     default:
@@ -1845,11 +2006,9 @@ private:
                     switch (*p)
                     {
                     case '.':
-                        buffer.push_back(to_double_.get_decimal_point());
                         state = numeric_check_state::fraction1;
                         break;
                     case 'e':case 'E':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp1;
                         break;
                     default:
@@ -1864,14 +2023,11 @@ private:
                     {
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
-                        buffer.push_back(*p);
                         break;
                     case '.':
-                        buffer.push_back(to_double_.get_decimal_point());
                         state = numeric_check_state::fraction1;
                         break;
                     case 'e':case 'E':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp1;
                         break;
                     default:
@@ -1886,12 +2042,10 @@ private:
                     {
                     case '0':
                         ++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::zero;
                         break;
                     case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::integer;
                         break;
                     default:
@@ -1907,7 +2061,6 @@ private:
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
                         ++decimal_places;
-                        buffer.push_back(*p);
                         state = numeric_check_state::fraction;
                         break;
                     default:
@@ -1923,10 +2076,8 @@ private:
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
                         ++decimal_places;
-                        buffer.push_back(*p);
                         break;
                     case 'e':case 'E':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp1;
                         break;
                     default:
@@ -1940,14 +2091,12 @@ private:
                     switch (*p)
                     {
                     case '-':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp;
                         break;
                     case '+':
                         state = numeric_check_state::exp;
                         break;
                     case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
-                        buffer.push_back(*p);
                         state = numeric_check_state::integer;
                         break;
                     default:
@@ -1961,7 +2110,6 @@ private:
                     switch (*p)
                     {
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
-                        buffer.push_back(*p);
                         break;
                     default:
                         state = numeric_check_state::done;
@@ -2023,12 +2171,29 @@ private:
             case numeric_check_state::fraction:
             case numeric_check_state::exp:
             {
-                if (options_.lossless_number())
+                if (lossless_number_)
                 {
                     more_ = visitor_->string_value(buffer_,semantic_tag::bigdec, *this, ec);
                 }
                 else
                 {
+                    // Build the conversion text only for cells that proved to
+                    // be floating point: '.' becomes the converter's decimal
+                    // point and a '+' exponent sign is dropped, as the
+                    // character-by-character copy used to do for every cell.
+                    std::string buffer;
+                    buffer.reserve(buffer_.length());
+                    for (auto p = buffer_.begin(); p != last; ++p)
+                    {
+                        if (*p == '.')
+                        {
+                            buffer.push_back(to_double_.get_decimal_point());
+                        }
+                        else if (*p != '+')
+                        {
+                            buffer.push_back(static_cast<char>(*p));
+                        }
+                    }
                     double d = to_double_(buffer.c_str(), buffer.length());
                     more_ = visitor_->double_value(d, semantic_tag::none, *this, ec);
                 }
@@ -318,6 +318,41 @@ TEST_CASE("csv_test_empty_values_with_defaults")
     CHECK(val[2]["string-f"].is<std::string>());
 }
 
+TEST_CASE("csv_test_integer_column_formats")
+{
+    std::string input = "int-f"
+"\n12"
+"\n+5"
+"\n007"
+"\n9 "
+"\n-07"
+"\n-009223372036854775808"
+"\n12abc"
+"\n0";
+
+    std::istringstream is(input);
+
+    json_decoder<json> decoder;
+
+    csv::csv_options options;
+    options.assume_header(true)
+           .column_types("integer")
+           .column_defaults("-1");
+
+    csv::csv_reader reader(is,decoder,options);
+    reader.read();
+    json val = decoder.get_result();
+
+    CHECK(val[0]["int-f"].as<int64_t>() == 12);
+    CHECK(val[1]["int-f"].as<int64_t>() == 5);   // leading '+'
+    CHECK(val[2]["int-f"].as<int64_t>() == 7);   // zero padded
+    CHECK(val[3]["int-f"].as<int64_t>() == 9);   // trailing space
+    CHECK(val[4]["int-f"].as<int64_t>() == -7);  // negative, zero padded
+    CHECK(val[5]["int-f"].as<int64_t>() == (std::numeric_limits<int64_t>::lowest)());
+    CHECK(val[6]["int-f"].as<int64_t>() == -1);  // trailing garbage -> default
+    CHECK(val[7]["int-f"].as<int64_t>() == 0);
+}
+
 TEST_CASE("csv_test_empty_values_with_empty_defaults")
 {
     std::string input = "bool-f,int-f,float-f,string-f"
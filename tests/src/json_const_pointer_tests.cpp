@@ -187,34 +187,37 @@ TEST_CASE("json_const_pointer double tests")
 
 namespace {
 
-    void flatten(const json& source, 
-                 const std::string& identifier, 
+    void flatten_item(const json& item,
+                      const std::string& identifier,
+                      json& result)
+    {
+        if (item.is_object())
+        {
+            auto it = item.find(identifier);
+            if (it != item.object_range().end() && !it->value().is_null())
+            {
+                result.emplace_back(json_const_pointer_arg, std::addressof(it->value()));
+            }
+        }
+    }
+
+    void flatten(const json& source,
+                 const std::string& identifier,
                  json& result)
     {
-        json temp(json_array_arg);
+        result.reserve(result.size() + source.size());
         for (auto& item : source.array_range())
         {
             if (item.is_array())
             {
                 for (auto& item_of_item : item.array_range())
                 {
-                    temp.emplace_back(json_const_pointer_arg,std::addressof(item_of_item));
+                    flatten_item(item_of_item, identifier, result);
                 }
             }
             else
             {
-                temp.emplace_back(json_const_pointer_arg, std::addressof(item));
-            }
-        }
-        for (const auto& item : temp.array_range())
-        {
-            if (!item.is_null())
-            {
-                const auto& j = item.contains(identifier) ? item.at(identifier) : json::null();
-                if (!j.is_null())
-                {
-                    result.emplace_back(json_const_pointer_arg, std::addressof(j));
-                }
+                flatten_item(item, identifier, result);
             }
         }
     }
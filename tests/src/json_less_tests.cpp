@@ -107,6 +107,94 @@ TEST_CASE("json integer less")
     }
 }
 
+TEST_CASE("json integer double less")
+{
+    SECTION("2^53 boundary compares exactly")
+    {
+        json lhs(int64_t(9007199254740993)); // 2^53 + 1
+        json rhs(9007199254740992.0);        // 2^53
+
+        CHECK_FALSE(lhs == rhs);
+        CHECK(rhs < lhs);
+        CHECK_FALSE(lhs < rhs);
+
+        json same(int64_t(9007199254740992));
+        CHECK(same == rhs);
+        CHECK_FALSE(same < rhs);
+        CHECK_FALSE(rhs < same);
+
+        json ulhs(uint64_t(9007199254740993));
+        CHECK_FALSE(ulhs == rhs);
+        CHECK(rhs < ulhs);
+        CHECK_FALSE(ulhs < rhs);
+    }
+    SECTION("doubles at or above 2^63 exceed every int64")
+    {
+        json lhs((std::numeric_limits<int64_t>::max)());
+        json rhs(9223372036854775808.0); // 2^63
+
+        CHECK(lhs < rhs);
+        CHECK_FALSE(rhs < lhs);
+    }
+    SECTION("INT64_MIN equals the double -2^63")
+    {
+        json lhs((std::numeric_limits<int64_t>::lowest)());
+        json rhs(-9223372036854775808.0); // -2^63
+
+        CHECK(lhs == rhs);
+        CHECK_FALSE(lhs < rhs);
+        CHECK_FALSE(rhs < lhs);
+
+        json below(-10000000000000000000.0); // < -2^63
+        CHECK(below < lhs);
+        CHECK_FALSE(lhs < below);
+    }
+    SECTION("doubles at or above 2^64 exceed every uint64")
+    {
+        json lhs((std::numeric_limits<uint64_t>::max)());
+        json rhs(18446744073709551616.0); // 2^64
+
+        CHECK(lhs < rhs);
+        CHECK_FALSE(rhs < lhs);
+
+        json neg(-1.0);
+        json zero(uint64_t(0));
+        CHECK(neg < zero);
+        CHECK_FALSE(zero < neg);
+    }
+    SECTION("NaN orders below integers on either side")
+    {
+        json i(int64_t(0));
+        json u(uint64_t(0));
+        // The converting constructor maps NaN to null; construct with a tag
+        // to get double storage holding NaN.
+        json nan(std::numeric_limits<double>::quiet_NaN(), semantic_tag::none);
+
+        CHECK_FALSE(i == nan);
+        CHECK(nan < i);
+        CHECK_FALSE(i < nan);
+        CHECK_FALSE(u == nan);
+        CHECK(nan < u);
+        CHECK_FALSE(u < nan);
+    }
+    SECTION("fractional part breaks ties")
+    {
+        json three(int64_t(3));
+        json four(int64_t(4));
+        json rhs(3.5);
+
+        CHECK(three < rhs);
+        CHECK_FALSE(rhs < three);
+        CHECK(rhs < four);
+        CHECK_FALSE(four < rhs);
+
+        json minus_four(int64_t(-4));
+        json minus_three_and_half(-3.5);
+        CHECK(minus_four < minus_three_and_half);
+        CHECK_FALSE(minus_three_and_half < minus_four);
+    }
+}
+
 TEST_CASE("json short string less")
 {
     json j1 = "bcd";